@@ -0,0 +1,284 @@
+#ifndef ALIGNMENT_SCORER_H
+#define ALIGNMENT_SCORER_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+using namespace std;
+
+// Counts typing errors as the edit distance between the typed input and the
+// best-matching prefix of the target text, so a skipped or extra character
+// costs one error instead of shifting every following position.
+//
+// Uses Myers' bit-parallel algorithm (block form, 64 target rows per word)
+// restricted to a band of rows around the typed length. State is
+// checkpointed after every typed space, so each update only replays the
+// current word plus any new characters.
+class AlignmentScorer {
+private:
+    // Only blocks inside the band are saved: blocks above it are never read
+    // again and blocks below it are re-initialised when they enter the band.
+    // Saved blocks are appended to the shared saved* arrays from offset.
+    struct Checkpoint {
+        int column;
+        int firstBlock;
+        int lastBlock;
+        int frozenScore;
+        size_t offset;
+    };
+
+    string target;
+    string input;
+    int band;
+    int blockCount;
+
+    // Match vectors per distinct target byte; symbolRow maps a byte to its
+    // row in peq (row 0 is the all-zero row for bytes absent from target).
+    unsigned short symbolRow[256];
+    vector<uint64_t> peq;
+
+    int column;
+    int firstBlock;
+    int lastBlock;
+    int frozenScore;
+    vector<uint64_t> pv;
+    vector<uint64_t> mv;
+    vector<int> scores;
+    vector<Checkpoint> checkpoints;
+    vector<uint64_t> savedPv;
+    vector<uint64_t> savedMv;
+    vector<int> savedScores;
+
+    int blockRows(int block) const;
+    void restore(const Checkpoint& cp);
+    void saveCheckpoint();
+    void advance(unsigned char c);
+    int bestScore() const;
+
+public:
+    AlignmentScorer(int bandWidth = 64);
+    void reset(const string& targetText);
+    int update(const string& typed);
+    int errors() const;
+};
+
+AlignmentScorer::AlignmentScorer(int bandWidth) {
+    band = max(bandWidth, 1);
+    blockCount = 0;
+    column = 0;
+    firstBlock = 0;
+    lastBlock = -1;
+    frozenScore = 0;
+    fill(symbolRow, symbolRow + 256, 0);
+}
+
+int AlignmentScorer::blockRows(int block) const {
+    if (block == blockCount - 1) {
+        return static_cast<int>(target.length()) - block * 64;
+    }
+    return 64;
+}
+
+void AlignmentScorer::reset(const string& targetText) {
+    target = targetText;
+    input = "";
+    blockCount = (static_cast<int>(target.length()) + 63) / 64;
+
+    fill(symbolRow, symbolRow + 256, 0);
+    int symbols = 1;
+    for (unsigned char c : target) {
+        if (symbolRow[c] == 0) {
+            symbolRow[c] = symbols++;
+        }
+    }
+    peq.assign(static_cast<size_t>(symbols) * blockCount, 0);
+    for (size_t i = 0; i < target.length(); i++) {
+        int row = symbolRow[static_cast<unsigned char>(target[i])];
+        peq[row * blockCount + i / 64] |= uint64_t(1) << (i % 64);
+    }
+
+    pv.assign(blockCount, ~uint64_t(0));
+    mv.assign(blockCount, 0);
+    scores.assign(blockCount, 0);
+    column = 0;
+    firstBlock = 0;
+    lastBlock = -1;
+    frozenScore = 0;
+
+    // Column 0: D[i][0] = i, so every active block starts all-positive.
+    int rowHi = min(static_cast<int>(target.length()), band);
+    int initialLast = rowHi == 0 ? 0 : (rowHi - 1) / 64;
+    for (int b = 0; b < blockCount && b <= initialLast; b++) {
+        scores[b] = (b == 0 ? 0 : scores[b - 1]) + blockRows(b);
+        lastBlock = b;
+    }
+
+    checkpoints.clear();
+    savedPv.clear();
+    savedMv.clear();
+    savedScores.clear();
+    saveCheckpoint();
+}
+
+void AlignmentScorer::saveCheckpoint() {
+    Checkpoint cp;
+    cp.column = column;
+    cp.firstBlock = firstBlock;
+    cp.lastBlock = lastBlock;
+    cp.frozenScore = frozenScore;
+    cp.offset = savedPv.size();
+    if (lastBlock >= firstBlock) {
+        savedPv.insert(savedPv.end(), pv.begin() + firstBlock, pv.begin() + lastBlock + 1);
+        savedMv.insert(savedMv.end(), mv.begin() + firstBlock, mv.begin() + lastBlock + 1);
+        savedScores.insert(savedScores.end(), scores.begin() + firstBlock, scores.begin() + lastBlock + 1);
+    }
+    checkpoints.push_back(cp);
+}
+
+void AlignmentScorer::restore(const Checkpoint& cp) {
+    column = cp.column;
+    firstBlock = cp.firstBlock;
+    lastBlock = cp.lastBlock;
+    frozenScore = cp.frozenScore;
+    int count = max(0, lastBlock - firstBlock + 1);
+    copy(savedPv.begin() + cp.offset, savedPv.begin() + cp.offset + count, pv.begin() + firstBlock);
+    copy(savedMv.begin() + cp.offset, savedMv.begin() + cp.offset + count, mv.begin() + firstBlock);
+    copy(savedScores.begin() + cp.offset, savedScores.begin() + cp.offset + count, scores.begin() + firstBlock);
+}
+
+void AlignmentScorer::advance(unsigned char c) {
+    int m = static_cast<int>(target.length());
+    int next = column + 1;
+    if (blockCount == 0) {
+        column = next;
+        return;
+    }
+
+    // Move the band to cover rows [next - band, next + band]. Blocks that
+    // fall above it are frozen (their bottom row is assumed to grow by one
+    // per column); blocks entering below start from the upper bound
+    // D[i][j] = D[top][j] + (i - top).
+    int rowLo = min(max(0, next - band), m);
+    int rowHi = min(m, next + band);
+    int newFirst = rowLo == 0 ? 0 : (rowLo - 1) / 64;
+    int newLast = rowHi == 0 ? 0 : (rowHi - 1) / 64;
+
+    while (firstBlock < newFirst) {
+        frozenScore = scores[firstBlock];
+        firstBlock++;
+    }
+    while (lastBlock < newLast) {
+        lastBlock++;
+        pv[lastBlock] = ~uint64_t(0);
+        mv[lastBlock] = 0;
+        scores[lastBlock] = scores[lastBlock - 1] + blockRows(lastBlock);
+    }
+
+    const uint64_t* eqRow = &peq[symbolRow[c] * blockCount];
+    int hin = 1;
+    for (int b = firstBlock; b <= lastBlock; b++) {
+        uint64_t Pv = pv[b];
+        uint64_t Mv = mv[b];
+        uint64_t Eq = eqRow[b];
+        uint64_t hinNeg = hin < 0 ? 1 : 0;
+        uint64_t hbit = uint64_t(1) << (blockRows(b) - 1);
+
+        uint64_t Xv = Eq | Mv;
+        Eq |= hinNeg;
+        uint64_t Xh = (((Eq & Pv) + Pv) ^ Pv) | Eq;
+        uint64_t Ph = Mv | ~(Xh | Pv);
+        uint64_t Mh = Pv & Xh;
+
+        int hout = 0;
+        if (Ph & hbit) {
+            hout = 1;
+        } else if (Mh & hbit) {
+            hout = -1;
+        }
+
+        Ph <<= 1;
+        Mh <<= 1;
+        Mh |= hinNeg;
+        if (hin > 0) {
+            Ph |= 1;
+        }
+        pv[b] = Mh | ~(Xv | Ph);
+        mv[b] = Ph & Xv;
+
+        scores[b] += hout;
+        hin = hout;
+    }
+
+    if (firstBlock > 0) {
+        frozenScore++;
+    }
+    column = next;
+}
+
+int AlignmentScorer::bestScore() const {
+    int m = static_cast<int>(target.length());
+    if (blockCount == 0) {
+        return column;
+    }
+
+    int rowLo = min(max(0, column - band), m);
+    int rowHi = min(m, column + band);
+
+    int row = firstBlock * 64;
+    int value = firstBlock == 0 ? column : frozenScore;
+    int best = (row >= rowLo) ? value : column + m;
+
+    for (int b = firstBlock; b <= lastBlock && row < rowHi; b++) {
+        int rows = blockRows(b);
+        for (int k = 0; k < rows && row < rowHi; k++) {
+            uint64_t bit = uint64_t(1) << k;
+            if (pv[b] & bit) {
+                value++;
+            } else if (mv[b] & bit) {
+                value--;
+            }
+            row++;
+            if (row >= rowLo && value < best) {
+                best = value;
+            }
+        }
+    }
+    return best;
+}
+
+int AlignmentScorer::update(const string& typed) {
+    size_t common = 0;
+    size_t limit = min(input.length(), typed.length());
+    while (common < limit && input[common] == typed[common]) {
+        common++;
+    }
+
+    // Roll back to the last word boundary that is still valid.
+    while (checkpoints.size() > 1 && checkpoints.back().column > static_cast<int>(common)) {
+        size_t offset = checkpoints.back().offset;
+        savedPv.resize(offset);
+        savedMv.resize(offset);
+        savedScores.resize(offset);
+        checkpoints.pop_back();
+    }
+    if (common < input.length()) {
+        restore(checkpoints.back());
+    }
+
+    input = typed;
+    for (size_t i = column; i < input.length(); i++) {
+        unsigned char c = static_cast<unsigned char>(input[i]);
+        advance(c);
+        if (c == ' ') {
+            saveCheckpoint();
+        }
+    }
+    return errors();
+}
+
+int AlignmentScorer::errors() const {
+    return bestScore();
+}
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef COMPRESSED_DICTIONARY_H
+#define COMPRESSED_DICTIONARY_H
+
+#include <string>
+#include <cstdint>
+using namespace std;
+
+// Read-only view over a front-coded word list produced by tools/dictgen.cpp.
+//
+// Words are sorted and split into blocks of blockSize entries. The first
+// word of a block is stored as [length][bytes]; every following word as
+// [shared prefix length][suffix length][suffix bytes] relative to the word
+// before it. blockOffsets[b] is the byte offset of block b in data, so a
+// lookup decodes at most blockSize entries.
+class CompressedDictionary {
+private:
+    const char* language;
+    int wordCount;
+    int blockSize;
+    const unsigned char* data;
+    int dataSize;
+    const uint32_t* blockOffsets;
+
+public:
+    CompressedDictionary(const char* lang, int count, int block,
+                         const unsigned char* bytes, int byteCount, const uint32_t* offsets);
+    const char* getLanguage() const;
+    int size() const;
+    int byteSize() const;
+    void appendWordAt(int index, string& out) const;
+    void wordAt(int index, string& out) const;
+    string wordAt(int index) const;
+};
+
+CompressedDictionary::CompressedDictionary(const char* lang, int count, int block,
+                                           const unsigned char* bytes, int byteCount,
+                                           const uint32_t* offsets) {
+    language = lang;
+    wordCount = count;
+    blockSize = block;
+    data = bytes;
+    dataSize = byteCount;
+    blockOffsets = offsets;
+}
+
+const char* CompressedDictionary::getLanguage() const {
+    return language;
+}
+
+int CompressedDictionary::size() const {
+    return wordCount;
+}
+
+int CompressedDictionary::byteSize() const {
+    int blocks = (wordCount + blockSize - 1) / blockSize;
+    return dataSize + blocks * static_cast<int>(sizeof(uint32_t));
+}
+
+void CompressedDictionary::appendWordAt(int index, string& out) const {
+    if (index < 0 || index >= wordCount) {
+        return;
+    }
+
+    // Decode straight into out: each entry keeps the first `shared` bytes
+    // of the previous word and appends its suffix.
+    size_t start = out.length();
+    const unsigned char* p = data + blockOffsets[index / blockSize];
+    int length = *p++;
+    out.append(reinterpret_cast<const char*>(p), length);
+    p += length;
+
+    for (int i = index % blockSize; i > 0; i--) {
+        int shared = *p++;
+        int suffix = *p++;
+        out.resize(start + shared);
+        out.append(reinterpret_cast<const char*>(p), suffix);
+        p += suffix;
+    }
+}
+
+void CompressedDictionary::wordAt(int index, string& out) const {
+    out.clear();
+    appendWordAt(index, out);
+}
+
+string CompressedDictionary::wordAt(int index) const {
+    string out;
+    wordAt(index, out);
+    return out;
+}
+
+#endif
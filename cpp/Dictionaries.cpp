@@ -0,0 +1,104 @@
+// Generated by tools/dictgen.cpp from dictionaries/*.txt. Do not edit.
+#ifndef DICTIONARIES_H
+#define DICTIONARIES_H
+
+#include <cstdint>
+#include <cstring>
+
+#include "CompressedDictionary.cpp"
+
+// en: 255 words, 1274 bytes
+static const unsigned char DICT_EN_DATA[] = {
+    5, 97, 98, 111, 118, 101, 1, 4, 102, 116, 101, 114, 1, 5, 110, 105, 109, 97, 108, 2,
+    1, 116, 5, 97, 112, 112, 108, 101, 0, 4, 98, 97, 99, 107, 2, 1, 116, 1, 4, 101,
+    97, 99, 104, 4, 98, 101, 97, 114, 2, 1, 100, 2, 1, 101, 2, 4, 102, 111, 114, 101,
+    5, 98, 101, 103, 105, 110, 2, 3, 108, 111, 119, 2, 3, 114, 114, 121, 1, 2, 105, 110,
+    4, 98, 105, 114, 100, 1, 4, 108, 97, 99, 107, 2, 2, 117, 101, 1, 3, 111, 97, 116,
+    3, 98, 111, 120, 1, 4, 114, 97, 110, 100, 3, 2, 118, 101, 2, 3, 101, 97, 100, 5,
+    98, 114, 101, 97, 107, 2, 3, 105, 110, 103, 2, 3, 111, 111, 109, 3, 2, 119, 110, 6,
+    98, 117, 99, 107, 101, 116, 2, 1, 103, 2, 3, 105, 108, 100, 2, 2, 108, 98, 4, 98,
+    117, 108, 108, 2, 1, 115, 2, 1, 121, 3, 2, 101, 114, 4, 99, 97, 108, 109, 2, 1,
+    110, 2, 3, 114, 114, 121, 2, 2, 115, 104, 3, 99, 97, 116, 3, 2, 99, 104, 1, 4,
+    104, 97, 105, 114, 2, 4, 111, 105, 99, 101, 4, 99, 105, 116, 121, 1, 4, 108, 101, 97,
+    110, 4, 1, 114, 2, 3, 105, 109, 98, 5, 99, 108, 111, 115, 101, 3, 2, 117, 100, 1,
+    5, 111, 114, 110, 101, 114, 2, 3, 118, 101, 114, 3, 99, 111, 119, 1, 3, 114, 97, 98,
+    3, 2, 110, 101, 3, 2, 116, 101, 4, 99, 114, 101, 119, 2, 2, 111, 119, 2, 1, 121,
+    0, 5, 100, 97, 110, 99, 101, 3, 100, 97, 121, 1, 3, 101, 97, 108, 1, 5, 105, 110,
+    110, 101, 114, 2, 3, 114, 116, 121, 2, 100, 111, 2, 1, 103, 1, 4, 114, 101, 97, 109,
+    2, 4, 105, 118, 101, 114, 4, 100, 114, 111, 112, 1, 3, 117, 99, 107, 0, 5, 101, 97,
+    103, 108, 101, 2, 3, 114, 108, 121, 5, 101, 97, 114, 116, 104, 0, 4, 102, 97, 108, 108,
+    2, 1, 110, 2, 2, 115, 116, 4, 102, 101, 97, 114, 2, 2, 101, 108, 1, 3, 105, 110,
+    100, 3, 3, 105, 115, 104, 4, 102, 105, 115, 104, 2, 1, 120, 1, 5, 108, 105, 103, 104,
+    116, 2, 4, 111, 119, 101, 114, 4, 102, 111, 111, 100, 2, 4, 114, 101, 115, 116, 1, 4,
+    114, 101, 115, 104, 2, 2, 111, 103, 5, 102, 114, 111, 110, 116, 2, 3, 117, 105, 116, 1,
+    2, 117, 110, 3, 2, 110, 121, 4, 103, 97, 109, 101, 1, 3, 101, 97, 114, 1, 3, 105,
+    118, 101, 1, 3, 111, 97, 116, 5, 103, 111, 111, 115, 101, 1, 4, 114, 97, 105, 110, 3,
+    2, 115, 115, 2, 3, 101, 101, 110, 5, 104, 97, 112, 112, 121, 2, 2, 116, 101, 2, 2,
+    119, 107, 1, 3, 101, 97, 114, 4, 104, 111, 112, 101, 2, 3, 114, 115, 101, 2, 2, 117,
+    114, 0, 6, 105, 110, 115, 101, 99, 116, 6, 105, 115, 108, 97, 110, 100, 0, 5, 106, 117,
+    105, 99, 101, 2, 2, 109, 112, 0, 4, 107, 101, 101, 112, 4, 107, 105, 110, 100, 3, 1,
+    103, 1, 3, 110, 111, 119, 0, 4, 108, 97, 107, 101, 4, 108, 97, 109, 112, 2, 2, 116,
+    101, 2, 3, 117, 103, 104, 1, 3, 101, 97, 102, 5, 108, 101, 97, 114, 110, 2, 2, 102,
+    116, 1, 4, 105, 103, 104, 116, 2, 2, 107, 101, 4, 108, 105, 111, 110, 1, 3, 111, 115,
+    101, 2, 2, 118, 101, 1, 4, 117, 110, 99, 104, 4, 109, 97, 105, 108, 2, 2, 107, 101,
+    2, 1, 112, 2, 4, 114, 107, 101, 116, 3, 109, 97, 116, 1, 3, 101, 97, 108, 1, 3,
+    105, 108, 107, 2, 4, 110, 117, 116, 101, 5, 109, 111, 100, 101, 108, 2, 4, 110, 107, 101,
+    121, 3, 2, 116, 104, 2, 1, 112, 5, 109, 111, 117, 115, 101, 1, 4, 117, 115, 105, 99,
+    0, 6, 110, 97, 116, 117, 114, 101, 1, 3, 101, 101, 100, 3, 110, 101, 119, 1, 4, 105,
+    103, 104, 116, 0, 5, 111, 99, 101, 97, 110, 1, 4, 102, 102, 101, 114, 3, 111, 108, 100,
+    1, 3, 112, 101, 110, 1, 4, 114, 100, 101, 114, 1, 3, 118, 101, 114, 3, 111, 119, 108,
+    0, 5, 112, 97, 112, 101, 114, 2, 2, 116, 104, 1, 4, 101, 97, 99, 101, 5, 112, 104,
+    111, 110, 101, 1, 3, 105, 99, 107, 2, 1, 103, 2, 4, 108, 108, 111, 119, 5, 112, 105,
+    108, 111, 116, 2, 2, 110, 107, 1, 4, 108, 97, 110, 116, 3, 1, 121, 4, 112, 111, 110,
+    100, 1, 4, 114, 105, 99, 101, 1, 3, 117, 108, 108, 2, 2, 115, 104, 5, 113, 117, 101,
+    101, 110, 2, 3, 105, 99, 107, 3, 2, 101, 116, 0, 6, 114, 97, 98, 98, 105, 116, 3,
+    114, 97, 116, 1, 4, 105, 103, 104, 116, 2, 2, 115, 101, 2, 3, 118, 101, 114, 4, 114,
+    111, 97, 100, 2, 3, 117, 103, 104, 1, 2, 117, 103, 2, 1, 110, 4, 115, 97, 105, 108,
+    2, 2, 108, 101, 1, 3, 101, 97, 108, 3, 1, 116, 6, 115, 101, 99, 111, 110, 100, 2,
+    1, 101, 2, 4, 108, 101, 99, 116, 2, 2, 110, 100, 5, 115, 104, 97, 114, 107, 4, 1,
+    112, 2, 3, 101, 101, 112, 4, 1, 116, 4, 115, 104, 105, 112, 2, 2, 111, 112, 3, 2,
+    117, 116, 1, 3, 105, 103, 110, 4, 115, 105, 110, 103, 2, 1, 116, 1, 4, 108, 101, 101,
+    112, 2, 2, 111, 119, 5, 115, 109, 97, 108, 108, 3, 2, 114, 116, 2, 3, 101, 108, 108,
+    2, 3, 105, 108, 101, 6, 115, 109, 111, 111, 116, 104, 1, 4, 110, 97, 107, 101, 1, 4,
+    111, 117, 110, 100, 1, 4, 112, 101, 97, 107, 5, 115, 116, 97, 110, 100, 3, 2, 114, 116,
+    2, 2, 111, 112, 3, 2, 114, 101, 6, 115, 116, 114, 101, 97, 109, 4, 2, 101, 116, 1,
+    3, 119, 97, 110, 2, 3, 101, 101, 116, 4, 115, 119, 105, 109, 0, 5, 116, 97, 98, 108,
+    101, 2, 2, 107, 101, 2, 3, 115, 116, 101, 5, 116, 101, 97, 99, 104, 1, 4, 104, 105,
+    110, 107, 2, 3, 114, 111, 119, 1, 4, 105, 103, 101, 114, 4, 116, 105, 109, 101, 1, 4,
+    111, 100, 97, 121, 2, 2, 111, 108, 2, 3, 117, 99, 104, 4, 116, 111, 119, 110, 1, 4,
+    114, 97, 99, 107, 3, 2, 105, 108, 4, 1, 110, 5, 116, 114, 97, 115, 104, 2, 2, 101,
+    101, 0, 5, 117, 110, 100, 101, 114, 0, 6, 118, 97, 108, 108, 101, 121, 5, 118, 111, 105,
+    99, 101, 0, 4, 119, 97, 107, 101, 2, 2, 108, 107, 2, 2, 110, 116, 4, 119, 97, 114,
+    109, 2, 3, 115, 116, 101, 2, 3, 116, 99, 104, 3, 2, 101, 114, 4, 119, 101, 101, 107,
+    1, 4, 104, 97, 108, 101, 2, 3, 105, 116, 101, 1, 3, 105, 108, 100, 4, 119, 105, 110,
+    100, 4, 2, 111, 119, 1, 3, 111, 114, 107, 1, 4, 114, 105, 116, 101, 4, 121, 101, 97,
+    114, 1, 4, 111, 117, 110, 103, 0, 5, 122, 101, 98, 114, 97,
+};
+
+static const uint32_t DICT_EN_BLOCKS[] = {
+    0, 22, 43, 60, 80, 100, 119, 139, 158, 173,
+    190, 210, 229, 251, 268, 287, 308, 326, 348, 367,
+    386, 407, 428, 447, 467, 488, 507, 529, 553, 572,
+    591, 611, 631, 649, 669, 688, 713, 736, 756, 777,
+    797, 816, 836, 859, 878, 895, 912, 932, 949, 967,
+    985, 1005, 1030, 1048, 1069, 1090, 1113, 1133, 1151, 1176,
+    1196, 1215, 1236, 1256,
+};
+
+static const CompressedDictionary DICTIONARIES[] = {
+    CompressedDictionary("en", 255, 4, DICT_EN_DATA, 1274, DICT_EN_BLOCKS),
+};
+
+static const int DICTIONARY_COUNT = 1;
+
+// Returns the dictionary for a language code, or the first one if unknown.
+static const CompressedDictionary* findDictionary(const char* language) {
+    for (int i = 0; i < DICTIONARY_COUNT; i++) {
+        if (language && strcmp(DICTIONARIES[i].getLanguage(), language) == 0) {
+            return &DICTIONARIES[i];
+        }
+    }
+    return &DICTIONARIES[0];
+}
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef DRILL_WORD_GENERATOR_H
+#define DRILL_WORD_GENERATOR_H
+
+#include <string>
+#include <vector>
+#include <random>
+#include <stdexcept>
+using namespace std;
+
+#include "TextGenerator.cpp"
+#include "Dictionaries.cpp"
+#include "WordFeatureIndex.cpp"
+
+// Generates words restricted by a WordQuery (key subset, rows, hands,
+// fingers, length). Matching indices are resolved once from the feature
+// index when the generator is created.
+class DrillWordGenerator : public TextGenerator {
+private:
+    const CompressedDictionary* dictionary;
+    vector<int> matches;
+
+public:
+    DrillWordGenerator(const CompressedDictionary* dict, const WordFeatureIndex& index, const WordQuery& query);
+    string generateText(int count) override;
+};
+
+DrillWordGenerator::DrillWordGenerator(const CompressedDictionary* dict, const WordFeatureIndex& index,
+                                       const WordQuery& query) {
+    dictionary = dict;
+    index.query(query, matches);
+}
+
+string DrillWordGenerator::generateText(int count) {
+    try {
+        if (count <= 0) {
+            throw invalid_argument("Word count must be positive");
+        }
+
+        if (!dictionary || matches.empty()) {
+            throw runtime_error("No words match the drill filter");
+        }
+
+        random_device rd;
+        mt19937 gen(rd());
+        uniform_int_distribution<> dis(0, matches.size() - 1);
+
+        string result;
+        result.reserve(count * 8);
+        for (int i = 0; i < count; i++) {
+            if (i > 0) {
+                result += ' ';
+            }
+            int randomIndex = matches[dis(gen)];
+            if (randomIndex < 0 || randomIndex >= dictionary->size()) {
+                throw out_of_range("Invalid word index");
+            }
+            dictionary->appendWordAt(randomIndex, result);
+        }
+
+        return result;
+    } catch (const invalid_argument& e) {
+        return "";
+    } catch (const runtime_error& e) {
+        return "";
+    } catch (const out_of_range& e) {
+        return "";
+    } catch (...) {
+        return "";
+    }
+}
+
+#endif
@@ -4,17 +4,27 @@
 #include <stdexcept>
 using namespace std;
 
+#include "AlignmentScorer.cpp"
+
+enum AccuracyMode {
+    POSITIONAL_ACCURACY = 0,
+    ALIGNED_ACCURACY = 1
+};
+
 class TypingSession {
 private:
     string targetText;
     string userInput;
     int correctChars;
     int totalChars;
+    AccuracyMode accuracyMode;
+    AlignmentScorer aligner;
 
 public:
     TypingSession();
     void startSession(string generatedText);
     void updateInput(string typed);
+    void setAccuracyMode(int mode);
     double accuracy();
     int wpm(double secondsElapsed);
     void reset();
@@ -25,6 +35,7 @@ TypingSession::TypingSession() {
     userInput = "";
     correctChars = 0;
     totalChars = 0;
+    accuracyMode = POSITIONAL_ACCURACY;
 }
 
 void TypingSession::startSession(string generatedText) {
@@ -32,6 +43,9 @@ void TypingSession::startSession(string generatedText) {
     userInput = "";
     correctChars = 0;
     totalChars = 0;
+    if (accuracyMode == ALIGNED_ACCURACY) {
+        aligner.reset(targetText);
+    }
 }
 
 void TypingSession::updateInput(string typed) {
@@ -39,6 +53,13 @@ void TypingSession::updateInput(string typed) {
     totalChars = typed.length();
     correctChars = 0;
 
+    if (accuracyMode == ALIGNED_ACCURACY) {
+        // One skipped or extra character counts as a single error.
+        int errors = aligner.update(typed);
+        correctChars = max(0, totalChars - errors);
+        return;
+    }
+
     int minLength = min(targetText.length(), typed.length());
     for (int i = 0; i < minLength; i++) {
         if (targetText[i] == typed[i]) {
@@ -47,6 +68,17 @@ void TypingSession::updateInput(string typed) {
     }
 }
 
+void TypingSession::setAccuracyMode(int mode) {
+    AccuracyMode newMode = (mode == ALIGNED_ACCURACY) ? ALIGNED_ACCURACY : POSITIONAL_ACCURACY;
+    if (newMode == accuracyMode) {
+        return;
+    }
+    accuracyMode = newMode;
+    // Positional mode never reads the scorer, so drop its tables.
+    aligner.reset(accuracyMode == ALIGNED_ACCURACY ? targetText : "");
+    updateInput(userInput);
+}
+
 double TypingSession::accuracy() {
     try {
         if (totalChars == 0) {
@@ -106,5 +138,8 @@ void TypingSession::reset() {
     userInput = "";
     correctChars = 0;
     totalChars = 0;
+    if (accuracyMode == ALIGNED_ACCURACY) {
+        aligner.reset(targetText);
+    }
 }
 
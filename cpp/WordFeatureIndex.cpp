@@ -0,0 +1,289 @@
+#ifndef WORD_FEATURE_INDEX_H
+#define WORD_FEATURE_INDEX_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cctype>
+#include <algorithm>
+using namespace std;
+
+#include "CompressedDictionary.cpp"
+
+// QWERTY rows, hands and fingers used for drill filters.
+enum KeyboardRow {
+    ROW_TOP = 1,
+    ROW_HOME = 2,
+    ROW_BOTTOM = 4
+};
+
+enum KeyboardHand {
+    HAND_LEFT = 1,
+    HAND_RIGHT = 2
+};
+
+// Fingers are numbered 0-7 from left pinky to right pinky; thumbs never
+// type letters.
+const int FINGER_COUNT = 8;
+const int LENGTH_BUCKETS = 16;
+const uint32_t ALL_LETTERS = (1u << 26) - 1;
+
+struct WordFeatures {
+    uint32_t letterMask;
+    uint8_t rowMask;
+    uint8_t handMask;
+    uint8_t fingerMask;
+    uint8_t length;
+    uint8_t lengthBucket;
+    bool hasOther;
+};
+
+// Filter for WordFeatureIndex::query. A word matches when it uses only
+// allowed letters/rows/hands/fingers, contains every required letter and
+// its length is within [minLength, maxLength].
+struct WordQuery {
+    uint32_t allowedLetters;
+    uint32_t requiredLetters;
+    int allowedRows;
+    int allowedHands;
+    int allowedFingers;
+    int minLength;
+    int maxLength;
+
+    WordQuery();
+    bool restrictsKeys() const;
+};
+
+WordQuery::WordQuery() {
+    allowedLetters = ALL_LETTERS;
+    requiredLetters = 0;
+    allowedRows = ROW_TOP | ROW_HOME | ROW_BOTTOM;
+    allowedHands = HAND_LEFT | HAND_RIGHT;
+    allowedFingers = (1 << FINGER_COUNT) - 1;
+    minLength = 1;
+    maxLength = 255;
+}
+
+// True when any letter, row, hand or finger is excluded. Characters outside
+// a-z have no row, hand or finger, so such queries reject words containing
+// them.
+bool WordQuery::restrictsKeys() const {
+    return (allowedLetters & ALL_LETTERS) != ALL_LETTERS ||
+           (allowedRows & (ROW_TOP | ROW_HOME | ROW_BOTTOM)) != (ROW_TOP | ROW_HOME | ROW_BOTTOM) ||
+           (allowedHands & (HAND_LEFT | HAND_RIGHT)) != (HAND_LEFT | HAND_RIGHT) ||
+           (allowedFingers & ((1 << FINGER_COUNT) - 1)) != (1 << FINGER_COUNT) - 1;
+}
+
+// Per-word features plus one bitset posting list per feature value, so a
+// query is a handful of word-wide AND/ANDNOT passes followed by a scan of
+// the set bits.
+class WordFeatureIndex {
+private:
+    int wordCount;
+    vector<WordFeatures> features;
+    vector<uint64_t> letterPostings[26];
+    vector<uint64_t> rowPostings[3];
+    vector<uint64_t> handPostings[2];
+    vector<uint64_t> fingerPostings[FINGER_COUNT];
+    vector<uint64_t> lengthPostings[LENGTH_BUCKETS];
+    vector<uint64_t> otherPostings;
+
+    static void setBit(vector<uint64_t>& bits, int index);
+    static void andNot(vector<uint64_t>& result, const vector<uint64_t>& bits);
+
+public:
+    WordFeatureIndex();
+    void build(const CompressedDictionary& dictionary);
+    void addWord(const string& word);
+    int size() const;
+    const WordFeatures& getFeatures(int index) const;
+    void query(const WordQuery& q, vector<int>& matches) const;
+
+    static WordFeatures computeFeatures(const string& word);
+    static uint32_t lettersFromKeys(const string& keys);
+};
+
+// Row and finger for 'a'..'z' on QWERTY.
+static const uint8_t LETTER_ROW[26] = {
+    ROW_HOME, ROW_BOTTOM, ROW_BOTTOM, ROW_HOME, ROW_TOP, ROW_HOME, ROW_HOME,   // a-g
+    ROW_HOME, ROW_TOP, ROW_HOME, ROW_HOME, ROW_HOME, ROW_BOTTOM, ROW_BOTTOM,  // h-n
+    ROW_TOP, ROW_TOP, ROW_TOP, ROW_TOP, ROW_HOME, ROW_TOP, ROW_TOP,           // o-u
+    ROW_BOTTOM, ROW_TOP, ROW_BOTTOM, ROW_TOP, ROW_BOTTOM                      // v-z
+};
+
+static const uint8_t LETTER_FINGER[26] = {
+    0, 3, 2, 2, 2, 3, 3,  // a-g
+    4, 5, 4, 5, 6, 4, 4,  // h-n
+    6, 7, 0, 3, 1, 3, 4,  // o-u
+    3, 1, 1, 4, 0         // v-z
+};
+
+WordFeatureIndex::WordFeatureIndex() {
+    wordCount = 0;
+}
+
+void WordFeatureIndex::setBit(vector<uint64_t>& bits, int index) {
+    size_t word = index / 64;
+    if (bits.size() <= word) {
+        bits.resize(word + 1, 0);
+    }
+    bits[word] |= uint64_t(1) << (index % 64);
+}
+
+void WordFeatureIndex::andNot(vector<uint64_t>& result, const vector<uint64_t>& bits) {
+    size_t n = min(result.size(), bits.size());
+    for (size_t i = 0; i < n; i++) {
+        result[i] &= ~bits[i];
+    }
+}
+
+WordFeatures WordFeatureIndex::computeFeatures(const string& word) {
+    WordFeatures f;
+    f.letterMask = 0;
+    f.rowMask = 0;
+    f.handMask = 0;
+    f.fingerMask = 0;
+    f.hasOther = false;
+    f.length = min<size_t>(word.length(), 255);
+    f.lengthBucket = min<int>(f.length, LENGTH_BUCKETS - 1);
+
+    for (char ch : word) {
+        int c = tolower(static_cast<unsigned char>(ch));
+        if (c < 'a' || c > 'z') {
+            f.hasOther = true;
+            continue;
+        }
+        int letter = c - 'a';
+        int finger = LETTER_FINGER[letter];
+        f.letterMask |= 1u << letter;
+        f.rowMask |= LETTER_ROW[letter];
+        f.fingerMask |= 1 << finger;
+        f.handMask |= finger < 4 ? HAND_LEFT : HAND_RIGHT;
+    }
+    return f;
+}
+
+uint32_t WordFeatureIndex::lettersFromKeys(const string& keys) {
+    uint32_t mask = 0;
+    for (char ch : keys) {
+        int c = tolower(static_cast<unsigned char>(ch));
+        if (c >= 'a' && c <= 'z') {
+            mask |= 1u << (c - 'a');
+        }
+    }
+    return mask;
+}
+
+void WordFeatureIndex::addWord(const string& word) {
+    WordFeatures f = computeFeatures(word);
+    int index = wordCount++;
+    features.push_back(f);
+
+    for (int letter = 0; letter < 26; letter++) {
+        if (f.letterMask & (1u << letter)) {
+            setBit(letterPostings[letter], index);
+        }
+    }
+    for (int row = 0; row < 3; row++) {
+        if (f.rowMask & (1 << row)) {
+            setBit(rowPostings[row], index);
+        }
+    }
+    for (int hand = 0; hand < 2; hand++) {
+        if (f.handMask & (1 << hand)) {
+            setBit(handPostings[hand], index);
+        }
+    }
+    for (int finger = 0; finger < FINGER_COUNT; finger++) {
+        if (f.fingerMask & (1 << finger)) {
+            setBit(fingerPostings[finger], index);
+        }
+    }
+    setBit(lengthPostings[f.lengthBucket], index);
+    if (f.hasOther) {
+        setBit(otherPostings, index);
+    }
+}
+
+void WordFeatureIndex::build(const CompressedDictionary& dictionary) {
+    string word;
+    for (int i = 0; i < dictionary.size(); i++) {
+        dictionary.wordAt(i, word);
+        addWord(word);
+    }
+}
+
+int WordFeatureIndex::size() const {
+    return wordCount;
+}
+
+const WordFeatures& WordFeatureIndex::getFeatures(int index) const {
+    return features[index];
+}
+
+void WordFeatureIndex::query(const WordQuery& q, vector<int>& matches) const {
+    matches.clear();
+    if (q.requiredLetters & ~q.allowedLetters) {
+        return;
+    }
+    size_t words = (wordCount + 63) / 64;
+    vector<uint64_t> result(words, 0);
+
+    int lo = min(max(q.minLength, 0), LENGTH_BUCKETS - 1);
+    int hi = min(q.maxLength, LENGTH_BUCKETS - 1);
+    for (int bucket = lo; bucket <= hi; bucket++) {
+        const vector<uint64_t>& bits = lengthPostings[bucket];
+        for (size_t i = 0; i < bits.size(); i++) {
+            result[i] |= bits[i];
+        }
+    }
+    // The last bucket holds every word of LENGTH_BUCKETS - 1 or more
+    // characters, so its members are checked against the exact range.
+    bool checkLongWords = hi == LENGTH_BUCKETS - 1;
+
+    for (int letter = 0; letter < 26; letter++) {
+        uint32_t bit = 1u << letter;
+        if (q.requiredLetters & bit) {
+            const vector<uint64_t>& bits = letterPostings[letter];
+            for (size_t i = 0; i < words; i++) {
+                result[i] &= i < bits.size() ? bits[i] : 0;
+            }
+        } else if (!(q.allowedLetters & bit)) {
+            andNot(result, letterPostings[letter]);
+        }
+    }
+    for (int row = 0; row < 3; row++) {
+        if (!(q.allowedRows & (1 << row))) {
+            andNot(result, rowPostings[row]);
+        }
+    }
+    for (int hand = 0; hand < 2; hand++) {
+        if (!(q.allowedHands & (1 << hand))) {
+            andNot(result, handPostings[hand]);
+        }
+    }
+    for (int finger = 0; finger < FINGER_COUNT; finger++) {
+        if (!(q.allowedFingers & (1 << finger))) {
+            andNot(result, fingerPostings[finger]);
+        }
+    }
+    if (q.restrictsKeys()) {
+        andNot(result, otherPostings);
+    }
+
+    for (size_t i = 0; i < words; i++) {
+        uint64_t bits = result[i];
+        while (bits) {
+            int index = static_cast<int>(i * 64) + __builtin_ctzll(bits);
+            bits &= bits - 1;
+            const WordFeatures& f = features[index];
+            if (checkLongWords && f.lengthBucket == LENGTH_BUCKETS - 1 &&
+                (f.length < q.minLength || f.length > q.maxLength)) {
+                continue;
+            }
+            matches.push_back(index);
+        }
+    }
+}
+
+#endif
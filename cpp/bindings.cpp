@@ -10,19 +10,35 @@ using namespace std;
 #include "RandomWordGenerator.cpp"
 #include "SentenceGenerator.cpp"
 #include "MixedCaseGenerator.cpp"
+#include "DrillWordGenerator.cpp"
 #include "TypingSession.cpp"
 #include "Timer.cpp"
 
 TextGenerator* textGen = nullptr;
 TypingSession* session = nullptr;
 Timer* timer = nullptr;
+int accuracyMode = POSITIONAL_ACCURACY;
+WordFeatureIndex* featureIndex = nullptr;
+WordQuery drillQuery;
+int generatorType = -1;
+string language = "en";
 
 enum GeneratorType {
     RANDOM_WORDS = 0,
     SENTENCES = 1,
-    MIXED_CASE = 2
+    MIXED_CASE = 2,
+    KEY_DRILL = 3
 };
 
+// Built on first use for the current language; setLanguage drops it.
+const WordFeatureIndex& getFeatureIndex() {
+    if (!featureIndex) {
+        featureIndex = new WordFeatureIndex();
+        featureIndex->build(*findDictionary(language.c_str()));
+    }
+    return *featureIndex;
+}
+
 extern "C" {
     EMSCRIPTEN_KEEPALIVE
     void setGeneratorType(int type) {
@@ -31,9 +47,10 @@ extern "C" {
             textGen = nullptr;
         }
         
+        generatorType = type;
         switch (type) {
             case RANDOM_WORDS:
-                textGen = new RandomWordGenerator();
+                textGen = new RandomWordGenerator(language.c_str());
                 break;
             case SENTENCES:
                 textGen = new SentenceGenerator();
@@ -41,11 +58,67 @@ extern "C" {
             case MIXED_CASE:
                 textGen = new MixedCaseGenerator();
                 break;
+            case KEY_DRILL:
+                textGen = new DrillWordGenerator(findDictionary(language.c_str()), getFeatureIndex(), drillQuery);
+                break;
             default:
-                textGen = new RandomWordGenerator();
+                textGen = new RandomWordGenerator(language.c_str());
+        }
+    }
+
+    // Selects the dictionary used by the random word and drill generators
+    // (a dictionaries/<lang>.txt code such as "en"); unknown codes fall back
+    // to the first dictionary.
+    EMSCRIPTEN_KEEPALIVE
+    void setLanguage(char* lang) {
+        if (!lang || lang[0] == '\0' || language == lang) {
+            return;
+        }
+        language = lang;
+        if (featureIndex) {
+            delete featureIndex;
+            featureIndex = nullptr;
+        }
+        if (generatorType == RANDOM_WORDS || generatorType == KEY_DRILL) {
+            setGeneratorType(generatorType);
         }
     }
     
+    // Restricts KEY_DRILL words. Empty allowedKeys and zero masks mean no
+    // restriction; rowMask uses KeyboardRow bits, handMask KeyboardHand bits
+    // and fingerMask bit 0 (left pinky) to bit 7 (right pinky).
+    EMSCRIPTEN_KEEPALIVE
+    void setDrillFilter(char* allowedKeys, char* requiredKeys, int rowMask, int handMask,
+                        int fingerMask, int minLength, int maxLength) {
+        WordQuery query;
+        if (allowedKeys && allowedKeys[0] != '\0') {
+            query.allowedLetters = WordFeatureIndex::lettersFromKeys(allowedKeys);
+        }
+        if (requiredKeys) {
+            query.requiredLetters = WordFeatureIndex::lettersFromKeys(requiredKeys);
+        }
+        if (rowMask > 0) {
+            query.allowedRows = rowMask;
+        }
+        if (handMask > 0) {
+            query.allowedHands = handMask;
+        }
+        if (fingerMask > 0) {
+            query.allowedFingers = fingerMask;
+        }
+        if (minLength > 0) {
+            query.minLength = minLength;
+        }
+        if (maxLength > 0) {
+            query.maxLength = maxLength;
+        }
+        drillQuery = query;
+
+        if (generatorType == KEY_DRILL) {
+            setGeneratorType(KEY_DRILL);
+        }
+    }
+
     EMSCRIPTEN_KEEPALIVE
     char* generateText(int wordCount) {
         // Helper function to safely allocate and return empty string
@@ -63,7 +136,7 @@ extern "C" {
             TextGenerator* localGen = textGen;
             if (!localGen) {
                 // Create default generator if none exists
-                localGen = new RandomWordGenerator();
+                localGen = new RandomWordGenerator(language.c_str());
                 textGen = localGen;
             }
             
@@ -114,6 +187,7 @@ extern "C" {
                 if (!session) {
                     throw bad_alloc();
                 }
+                session->setAccuracyMode(accuracyMode);
             }
             if (!timer) {
                 timer = new Timer();
@@ -147,6 +221,14 @@ extern "C" {
         }
     }
 
+    EMSCRIPTEN_KEEPALIVE
+    void setAccuracyMode(int mode) {
+        accuracyMode = mode;
+        if (session) {
+            session->setAccuracyMode(mode);
+        }
+    }
+
     EMSCRIPTEN_KEEPALIVE
     double getAccuracy() {
         if (session) {
@@ -96,9 +96,13 @@ export async function loadWasm() {
 
   wasmFunctions = {
     setGeneratorType: wasmModule.cwrap("setGeneratorType", "void", ["number"]),
+    setDrillFilter: wasmModule.cwrap("setDrillFilter", "void",
+      ["string", "string", "number", "number", "number", "number", "number"]),
+    setLanguage: wasmModule.cwrap("setLanguage", "void", ["string"]),
     generateText: generateText,
     startSession: wasmModule.cwrap("startSession", "void", ["string"]),
     updateInput: wasmModule.cwrap("updateInput", "void", ["string"]),
+    setAccuracyMode: wasmModule.cwrap("setAccuracyMode", "void", ["number"]),
     getAccuracy: wasmModule.cwrap("getAccuracy", "number", []),
     getWPM: wasmModule.cwrap("getWPM", "number", ["number"]),
     resetSession: wasmModule.cwrap("resetSession", "void", []),
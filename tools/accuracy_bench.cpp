@@ -0,0 +1,182 @@
+// Native benchmark comparing positional and aligned accuracy modes.
+// Replays a keystroke-by-keystroke typing run (full input string per call,
+// as the JS front end does) over a ~1000 character passage.
+//
+// Before timing, AlignmentScorer is checked against a plain O(nm) edit
+// distance DP over random typing, backspace, edit and paste sequences; the
+// program exits non-zero on any mismatch within the band.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+#include "SentenceGenerator.cpp"
+#include "TypingSession.cpp"
+
+struct BenchResult {
+    double nsPerKeystroke;
+    double finalAccuracy;
+};
+
+static string makePassage(int targetLength) {
+    SentenceGenerator gen;
+    string text;
+    while (static_cast<int>(text.length()) < targetLength) {
+        text += (text.empty() ? "" : " ") + gen.generateText(1);
+    }
+    if (static_cast<int>(text.length()) > targetLength) {
+        text.resize(targetLength);
+    }
+    return text;
+}
+
+// Types the passage with one skipped character near the start and a typo
+// followed by a backspace every 50 characters.
+static vector<string> makeKeystrokes(const string& target) {
+    vector<string> inputs;
+    string typed;
+    size_t skipAt = target.length() / 10;
+    for (size_t i = 0; i < target.length(); i++) {
+        if (i == skipAt) {
+            continue;
+        }
+        if (i % 50 == 25) {
+            typed.push_back('#');
+            inputs.push_back(typed);
+            typed.pop_back();
+            inputs.push_back(typed);
+        }
+        typed.push_back(target[i]);
+        inputs.push_back(typed);
+    }
+    return inputs;
+}
+
+static BenchResult run(const string& target, const vector<string>& inputs, int mode, int rounds) {
+    TypingSession session;
+    session.setAccuracyMode(mode);
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        session.startSession(target);
+        for (const string& typed : inputs) {
+            session.updateInput(typed);
+        }
+    }
+    auto end = chrono::steady_clock::now();
+    double ns = chrono::duration<double, nano>(end - start).count();
+
+    BenchResult result;
+    result.nsPerKeystroke = ns / (static_cast<double>(inputs.size()) * rounds);
+    result.finalAccuracy = session.accuracy();
+    return result;
+}
+
+// min over i of D[i][n]: edit distance between typed and the best-matching
+// prefix of target.
+static int referenceErrors(const string& target, const string& typed) {
+    size_t m = target.length();
+    vector<int> column(m + 1);
+    for (size_t i = 0; i <= m; i++) {
+        column[i] = i;
+    }
+    for (size_t j = 1; j <= typed.length(); j++) {
+        int diagonal = column[0];
+        column[0] = j;
+        for (size_t i = 1; i <= m; i++) {
+            int above = column[i];
+            int cost = target[i - 1] == typed[j - 1] ? 0 : 1;
+            column[i] = min(min(column[i - 1] + 1, above + 1), diagonal + cost);
+            diagonal = above;
+        }
+    }
+    int best = column[0];
+    for (size_t i = 1; i <= m; i++) {
+        best = min(best, column[i]);
+    }
+    return best;
+}
+
+// Returns the number of updates where AlignmentScorer disagreed with the
+// reference while the reference distance was within the band.
+static int checkAgainstReference(int sequences, int steps, long long* checked) {
+    const int band = 64;
+    mt19937 gen(7);
+    int mismatches = 0;
+    *checked = 0;
+
+    for (int s = 0; s < sequences; s++) {
+        int m = gen() % 300;
+        string target;
+        for (int i = 0; i < m; i++) {
+            target += (gen() % 6 == 0) ? ' ' : static_cast<char>('a' + gen() % 4);
+        }
+
+        AlignmentScorer scorer(band);
+        scorer.reset(target);
+        string typed;
+        for (int step = 0; step < steps; step++) {
+            int action = gen() % 10;
+            size_t p = typed.length();
+            if (action < 5 && p < target.length()) {
+                typed += (gen() % 8 == 0) ? static_cast<char>('a' + gen() % 4) : target[p];
+            } else if (action < 6 && p + 1 < target.length()) {
+                typed += target[p + 1];
+            } else if (action < 7 && !typed.empty()) {
+                typed.pop_back();
+            } else if (action < 8) {
+                typed += static_cast<char>('a' + gen() % 5);
+            } else if (action < 9 && p < target.length()) {
+                typed.append(target, p, 1 + gen() % 40);
+            } else if (!typed.empty()) {
+                typed.resize(gen() % typed.length());
+            }
+
+            int got = scorer.update(typed);
+            int want = referenceErrors(target, typed);
+            if (want > band) {
+                continue;
+            }
+            (*checked)++;
+            if (got != want) {
+                if (mismatches < 5) {
+                    fprintf(stderr, "mismatch: target %zu chars, typed %zu chars: got %d, want %d\n",
+                            target.length(), typed.length(), got, want);
+                }
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+int main(int argc, char** argv) {
+    int length = argc > 1 ? atoi(argv[1]) : 1000;
+    int rounds = argc > 2 ? atoi(argv[2]) : 200;
+    if (length <= 0 || rounds <= 0) {
+        fprintf(stderr, "usage: %s [passage_length] [rounds]\n", argv[0]);
+        return 1;
+    }
+
+    long long checked = 0;
+    int mismatches = checkAgainstReference(200, 150, &checked);
+    printf("reference check: %lld updates, %d mismatches\n", checked, mismatches);
+    if (mismatches > 0) {
+        return 1;
+    }
+
+    string target = makePassage(length);
+    vector<string> inputs = makeKeystrokes(target);
+
+    BenchResult positional = run(target, inputs, POSITIONAL_ACCURACY, rounds);
+    BenchResult aligned = run(target, inputs, ALIGNED_ACCURACY, rounds);
+
+    printf("passage: %zu chars, %zu keystrokes x %d rounds\n", target.length(), inputs.size(), rounds);
+    printf("%-12s %14s %12s\n", "mode", "ns/keystroke", "accuracy");
+    printf("%-12s %14.1f %11.2f%%\n", "positional", positional.nsPerKeystroke, positional.finalAccuracy);
+    printf("%-12s %14.1f %11.2f%%\n", "aligned", aligned.nsPerKeystroke, aligned.finalAccuracy);
+    return 0;
+}
@@ -0,0 +1,172 @@
+// Builds cpp/Dictionaries.cpp from plain word lists (one word per line).
+// Each list is sorted, de-duplicated and front-coded into blocks (see
+// cpp/CompressedDictionary.cpp). Lines starting with '#' are ignored.
+//
+// usage: dictgen [-m max_length] [-b block_size] output.cpp lang=list.txt ...
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+using namespace std;
+
+struct EncodedDictionary {
+    string language;
+    int wordCount;
+    vector<unsigned char> data;
+    vector<unsigned int> blockOffsets;
+};
+
+static bool readWords(const string& path, int maxLength, vector<string>& words) {
+    ifstream in(path);
+    if (!in) {
+        fprintf(stderr, "dictgen: cannot open %s\n", path.c_str());
+        return false;
+    }
+    string line;
+    while (getline(in, line)) {
+        while (!line.empty() && (line.back() == '\r' || line.back() == ' ' || line.back() == '\t')) {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        if (line.length() > 255 || (maxLength > 0 && static_cast<int>(line.length()) > maxLength)) {
+            fprintf(stderr, "dictgen: %s: skipping \"%s\" (longer than %d)\n",
+                    path.c_str(), line.c_str(), maxLength > 0 ? maxLength : 255);
+            continue;
+        }
+        words.push_back(line);
+    }
+    sort(words.begin(), words.end());
+    words.erase(unique(words.begin(), words.end()), words.end());
+    return true;
+}
+
+static EncodedDictionary encode(const string& language, const vector<string>& words, int blockSize) {
+    EncodedDictionary dict;
+    dict.language = language;
+    dict.wordCount = words.size();
+
+    for (size_t i = 0; i < words.size(); i++) {
+        const string& word = words[i];
+        if (i % blockSize == 0) {
+            dict.blockOffsets.push_back(dict.data.size());
+            dict.data.push_back(word.length());
+            dict.data.insert(dict.data.end(), word.begin(), word.end());
+            continue;
+        }
+        const string& prev = words[i - 1];
+        size_t shared = 0;
+        while (shared < prev.length() && shared < word.length() && prev[shared] == word[shared]) {
+            shared++;
+        }
+        dict.data.push_back(shared);
+        dict.data.push_back(word.length() - shared);
+        dict.data.insert(dict.data.end(), word.begin() + shared, word.end());
+    }
+    return dict;
+}
+
+static string identifier(const string& language) {
+    string id;
+    for (char c : language) {
+        id += isalnum(static_cast<unsigned char>(c)) ? toupper(c) : '_';
+    }
+    return id;
+}
+
+static void writeSource(FILE* out, const vector<EncodedDictionary>& dicts, int blockSize) {
+    fprintf(out, "// Generated by tools/dictgen.cpp from dictionaries/*.txt. Do not edit.\n");
+    fprintf(out, "#ifndef DICTIONARIES_H\n#define DICTIONARIES_H\n\n");
+    fprintf(out, "#include <cstdint>\n#include <cstring>\n\n");
+    fprintf(out, "#include \"CompressedDictionary.cpp\"\n\n");
+
+    for (const EncodedDictionary& dict : dicts) {
+        string id = identifier(dict.language);
+        fprintf(out, "// %s: %d words, %zu bytes\n", dict.language.c_str(), dict.wordCount, dict.data.size());
+        fprintf(out, "static const unsigned char DICT_%s_DATA[] = {", id.c_str());
+        for (size_t i = 0; i < dict.data.size(); i++) {
+            fprintf(out, "%s%u,", i % 20 == 0 ? "\n    " : " ", dict.data[i]);
+        }
+        fprintf(out, "\n};\n\n");
+        fprintf(out, "static const uint32_t DICT_%s_BLOCKS[] = {", id.c_str());
+        for (size_t i = 0; i < dict.blockOffsets.size(); i++) {
+            fprintf(out, "%s%u,", i % 10 == 0 ? "\n    " : " ", dict.blockOffsets[i]);
+        }
+        fprintf(out, "\n};\n\n");
+    }
+
+    fprintf(out, "static const CompressedDictionary DICTIONARIES[] = {\n");
+    for (const EncodedDictionary& dict : dicts) {
+        string id = identifier(dict.language);
+        fprintf(out, "    CompressedDictionary(\"%s\", %d, %d, DICT_%s_DATA, %zu, DICT_%s_BLOCKS),\n",
+                dict.language.c_str(), dict.wordCount, blockSize, id.c_str(), dict.data.size(), id.c_str());
+    }
+    fprintf(out, "};\n\n");
+    fprintf(out, "static const int DICTIONARY_COUNT = %zu;\n\n", dicts.size());
+
+    fprintf(out, "// Returns the dictionary for a language code, or the first one if unknown.\n");
+    fprintf(out, "static const CompressedDictionary* findDictionary(const char* language) {\n");
+    fprintf(out, "    for (int i = 0; i < DICTIONARY_COUNT; i++) {\n");
+    fprintf(out, "        if (language && strcmp(DICTIONARIES[i].getLanguage(), language) == 0) {\n");
+    fprintf(out, "            return &DICTIONARIES[i];\n");
+    fprintf(out, "        }\n");
+    fprintf(out, "    }\n");
+    fprintf(out, "    return &DICTIONARIES[0];\n");
+    fprintf(out, "}\n\n");
+    fprintf(out, "#endif\n");
+}
+
+int main(int argc, char** argv) {
+    int maxLength = 0;
+    int blockSize = 4;
+    int arg = 1;
+    while (arg + 1 < argc && argv[arg][0] == '-') {
+        if (strcmp(argv[arg], "-m") == 0) {
+            maxLength = atoi(argv[arg + 1]);
+        } else if (strcmp(argv[arg], "-b") == 0) {
+            blockSize = atoi(argv[arg + 1]);
+        } else {
+            break;
+        }
+        arg += 2;
+    }
+    if (argc - arg < 2 || blockSize <= 0) {
+        fprintf(stderr, "usage: %s [-m max_length] [-b block_size] output.cpp lang=list.txt ...\n", argv[0]);
+        return 1;
+    }
+
+    const char* outputPath = argv[arg++];
+    vector<EncodedDictionary> dicts;
+    for (; arg < argc; arg++) {
+        string spec = argv[arg];
+        size_t eq = spec.find('=');
+        if (eq == string::npos || eq == 0) {
+            fprintf(stderr, "dictgen: expected lang=path, got %s\n", spec.c_str());
+            return 1;
+        }
+        vector<string> words;
+        if (!readWords(spec.substr(eq + 1), maxLength, words)) {
+            return 1;
+        }
+        if (words.empty()) {
+            fprintf(stderr, "dictgen: %s has no words\n", spec.c_str());
+            return 1;
+        }
+        dicts.push_back(encode(spec.substr(0, eq), words, blockSize));
+    }
+
+    FILE* out = fopen(outputPath, "w");
+    if (!out) {
+        fprintf(stderr, "dictgen: cannot write %s\n", outputPath);
+        return 1;
+    }
+    writeSource(out, dicts, blockSize);
+    fclose(out);
+    return 0;
+}
@@ -0,0 +1,100 @@
+// Native benchmark for WordFeatureIndex queries on a large synthetic corpus,
+// against a linear scan over the precomputed per-word features.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+#include "WordFeatureIndex.cpp"
+
+struct NamedQuery {
+    const char* name;
+    WordQuery query;
+};
+
+static bool scanMatches(const WordFeatures& f, const WordQuery& q) {
+    if ((f.letterMask & ~q.allowedLetters) || (f.letterMask & q.requiredLetters) != q.requiredLetters) {
+        return false;
+    }
+    if ((f.rowMask & ~q.allowedRows) || (f.handMask & ~q.allowedHands) || (f.fingerMask & ~q.allowedFingers)) {
+        return false;
+    }
+    if (f.hasOther && q.restrictsKeys()) {
+        return false;
+    }
+    return f.length >= q.minLength && f.length <= q.maxLength;
+}
+
+int main(int argc, char** argv) {
+    int corpusSize = argc > 1 ? atoi(argv[1]) : 100000;
+    int rounds = argc > 2 ? atoi(argv[2]) : 200;
+    if (corpusSize <= 0 || rounds <= 0) {
+        fprintf(stderr, "usage: %s [corpus_size] [rounds]\n", argv[0]);
+        return 1;
+    }
+
+    // Letter frequencies roughly follow English so home-row-only words exist;
+    // the apostrophe checks that key-restricted queries drop non-letters.
+    const string letters = "eeeeeeetttttaaaaaoooooiiiiinnnnnsssshhhhrrrrddlllcumwfgypbvkjxqz'";
+    mt19937 gen(42);
+    uniform_int_distribution<> letterDis(0, letters.size() - 1);
+    uniform_int_distribution<> lengthDis(2, 12);
+
+    WordFeatureIndex index;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < corpusSize; i++) {
+        string word;
+        int length = lengthDis(gen);
+        for (int k = 0; k < length; k++) {
+            word += letters[letterDis(gen)];
+        }
+        index.addWord(word);
+    }
+    double buildMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    printf("corpus: %d words, index built in %.1f ms\n", corpusSize, buildMs);
+
+    vector<NamedQuery> queries(4);
+    queries[0].name = "home row only";
+    queries[0].query.allowedRows = ROW_HOME;
+    queries[1].name = "length 4-6 with q";
+    queries[1].query.requiredLetters = WordFeatureIndex::lettersFromKeys("q");
+    queries[1].query.minLength = 4;
+    queries[1].query.maxLength = 6;
+    queries[2].name = "left hand only";
+    queries[2].query.allowedHands = HAND_LEFT;
+    queries[3].name = "keys asdfjkleh";
+    queries[3].query.allowedLetters = WordFeatureIndex::lettersFromKeys("asdfjkleh");
+
+    printf("%-20s %10s %14s %14s\n", "query", "matches", "index us", "scan us");
+    vector<int> matches;
+    for (const NamedQuery& nq : queries) {
+        start = chrono::steady_clock::now();
+        for (int r = 0; r < rounds; r++) {
+            index.query(nq.query, matches);
+        }
+        double indexUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / rounds;
+
+        vector<int> scanned;
+        start = chrono::steady_clock::now();
+        for (int r = 0; r < rounds; r++) {
+            scanned.clear();
+            for (int i = 0; i < index.size(); i++) {
+                if (scanMatches(index.getFeatures(i), nq.query)) {
+                    scanned.push_back(i);
+                }
+            }
+        }
+        double scanUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / rounds;
+
+        if (scanned != matches) {
+            fprintf(stderr, "%s: index and scan disagree\n", nq.name);
+            return 1;
+        }
+        printf("%-20s %10zu %14.1f %14.1f\n", nq.name, matches.size(), indexUs, scanUs);
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+// Native benchmark for RandomWordGenerator::generateText throughput over the
+// compressed dictionaries, against the previous vector<Word> sampling loop.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+using namespace std;
+
+#include "RandomWordGenerator.cpp"
+#include "Word.cpp"
+
+// The sampling loop generateText used before the dictionaries were compressed.
+static string generateFromVector(const vector<Word>& words, int count) {
+    random_device rd;
+    mt19937 gen(rd());
+    uniform_int_distribution<> dis(0, words.size() - 1);
+    ostringstream result;
+    for (int i = 0; i < count; i++) {
+        if (i > 0) {
+            result << " ";
+        }
+        Word selectedWord = words[dis(gen)];
+        result << selectedWord.getText();
+    }
+    return result.str();
+}
+
+int main(int argc, char** argv) {
+    int calls = argc > 1 ? atoi(argv[1]) : 200000;
+    int wordsPerCall = argc > 2 ? atoi(argv[2]) : 50;
+    if (calls <= 0 || wordsPerCall <= 0) {
+        fprintf(stderr, "usage: %s [calls] [words_per_call]\n", argv[0]);
+        return 1;
+    }
+
+    printf("%-8s %8s %12s %12s %14s %14s\n", "lang", "words", "dict bytes", "plain bytes",
+           "compressed/s", "vector/s");
+    for (int d = 0; d < DICTIONARY_COUNT; d++) {
+        const CompressedDictionary& dict = DICTIONARIES[d];
+        vector<Word> words;
+        size_t plainBytes = 0;
+        for (int i = 0; i < dict.size(); i++) {
+            words.push_back(Word(dict.wordAt(i), "general"));
+            plainBytes += sizeof(Word) + words.back().getLength() + 1;
+        }
+        // The two loops alternate in small batches so clock drift, cache
+        // state and random_device cost affect both equally.
+        RandomWordGenerator generator(dict.getLanguage());
+        size_t sink = 0;
+        double compressedSec = 0;
+        double vectorSec = 0;
+        const int batch = 500;
+        for (int done = 0; done < calls; done += batch) {
+            int n = min(batch, calls - done);
+            for (int pass = 0; pass < 2; pass++) {
+                bool compressedPass = (pass == 0) == ((done / batch) % 2 == 0);
+                auto start = chrono::steady_clock::now();
+                for (int i = 0; i < n; i++) {
+                    if (compressedPass) {
+                        sink += generator.generateText(wordsPerCall).length();
+                    } else {
+                        sink += generateFromVector(words, wordsPerCall).length();
+                    }
+                }
+                double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+                (compressedPass ? compressedSec : vectorSec) += elapsed;
+            }
+        }
+
+        printf("%-8s %8d %12d %12zu %14.0f %14.0f\n", dict.getLanguage(), dict.size(), dict.byteSize(),
+               plainBytes, calls / compressedSec, calls / vectorSec);
+        if (sink == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
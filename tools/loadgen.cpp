@@ -0,0 +1,402 @@
+// Synthetic typist load generator for TypingSession.
+//
+// Simulates many concurrent typists spread over all cores. Each input event
+// calls TypingSession the way bindings.cpp does for the front end
+// (startSession, then updateInput + accuracy per keystroke, wpm at the end);
+// the bindings themselves are not used because they hold one global session.
+//
+// usage: loadgen [--sessions N] [--threads N] [--words N] [--mode positional|aligned]
+//                [--wpm-mean F] [--wpm-stddev F] [--error-rate F] [--backspace-rate F]
+//                [--burst-rate F] [--burst-size N] [--seed N]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace std;
+
+#include "Dictionaries.cpp"
+#include "TypingSession.cpp"
+
+// Live heap bytes, tracked by the operator new/delete overrides below so
+// memory per session can be reported without platform-specific APIs.
+// Counting is switched on only while measureSessionBytes runs (after the
+// worker threads have joined), so the timed phase never touches the shared
+// counter. Each block's header records whether it was counted.
+static long long liveBytes = 0;
+static bool countAllocations = false;
+static const size_t ALLOC_HEADER = 16;
+
+void* operator new(size_t size) {
+    void* raw = malloc(size + ALLOC_HEADER);
+    if (!raw) {
+        throw bad_alloc();
+    }
+    size_t* header = static_cast<size_t*>(raw);
+    header[0] = size;
+    header[1] = countAllocations;
+    if (countAllocations) {
+        liveBytes += size;
+    }
+    return static_cast<char*>(raw) + ALLOC_HEADER;
+}
+
+void operator delete(void* p) noexcept {
+    if (!p) {
+        return;
+    }
+    void* raw = static_cast<char*>(p) - ALLOC_HEADER;
+    size_t* header = static_cast<size_t*>(raw);
+    if (header[1]) {
+        liveBytes -= header[0];
+    }
+    free(raw);
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete[](void* p) noexcept {
+    operator delete(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    operator delete(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    operator delete(p);
+}
+
+struct LoadConfig {
+    int sessions;
+    int threads;
+    int words;
+    int mode;
+    double wpmMean;
+    double wpmStddev;
+    double errorRate;
+    double backspaceRate;
+    double burstRate;
+    int burstSize;
+    unsigned int seed;
+};
+
+enum PendingError {
+    NO_ERROR = 0,
+    SUBSTITUTED_CHAR = 1,
+    EXTRA_CHAR = 2
+};
+
+struct SimulatedTypist {
+    TypingSession session;
+    string target;
+    string typed;
+    double wpm;
+    double startClock;
+    double clock;
+    size_t nextChar;
+    PendingError pendingError;
+
+    bool finished() const;
+};
+
+bool SimulatedTypist::finished() const {
+    return nextChar >= target.length() || typed.length() >= target.length();
+}
+
+// One per worker thread; aligned so neighbouring threads' counters never
+// share a cache line.
+struct alignas(64) ThreadStats {
+    long long events;
+    long long chars;
+    double accuracySum;
+    double wpmSum;
+    int finished;
+    vector<uint32_t> updateLatencies;
+    vector<uint32_t> accuracyLatencies;
+};
+
+static void printUsage(const char* program) {
+    fprintf(stderr,
+            "usage: %s [--sessions N] [--threads N] [--words N] [--mode positional|aligned]\n"
+            "          [--wpm-mean F] [--wpm-stddev F] [--error-rate F] [--backspace-rate F]\n"
+            "          [--burst-rate F] [--burst-size N] [--seed N]\n",
+            program);
+}
+
+static bool parseArgs(int argc, char** argv, LoadConfig& config) {
+    config.sessions = 2000;
+    config.threads = max(1u, thread::hardware_concurrency());
+    config.words = 50;
+    config.mode = ALIGNED_ACCURACY;
+    config.wpmMean = 60.0;
+    config.wpmStddev = 15.0;
+    config.errorRate = 0.03;
+    config.backspaceRate = 0.8;
+    config.burstRate = 0.002;
+    config.burstSize = 40;
+    config.seed = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) {
+            return false;
+        }
+        const char* flag = argv[i];
+        const char* value = argv[++i];
+        if (strcmp(flag, "--sessions") == 0) {
+            config.sessions = atoi(value);
+        } else if (strcmp(flag, "--threads") == 0) {
+            config.threads = atoi(value);
+        } else if (strcmp(flag, "--words") == 0) {
+            config.words = atoi(value);
+        } else if (strcmp(flag, "--mode") == 0) {
+            if (strcmp(value, "positional") == 0) {
+                config.mode = POSITIONAL_ACCURACY;
+            } else if (strcmp(value, "aligned") == 0) {
+                config.mode = ALIGNED_ACCURACY;
+            } else {
+                return false;
+            }
+        } else if (strcmp(flag, "--wpm-mean") == 0) {
+            config.wpmMean = atof(value);
+        } else if (strcmp(flag, "--wpm-stddev") == 0) {
+            config.wpmStddev = atof(value);
+        } else if (strcmp(flag, "--error-rate") == 0) {
+            config.errorRate = atof(value);
+        } else if (strcmp(flag, "--backspace-rate") == 0) {
+            config.backspaceRate = atof(value);
+        } else if (strcmp(flag, "--burst-rate") == 0) {
+            config.burstRate = atof(value);
+        } else if (strcmp(flag, "--burst-size") == 0) {
+            config.burstSize = atoi(value);
+        } else if (strcmp(flag, "--seed") == 0) {
+            config.seed = strtoul(value, nullptr, 10);
+        } else {
+            return false;
+        }
+    }
+    return config.sessions > 0 && config.threads > 0 && config.words > 0 && config.burstSize > 0 &&
+           config.wpmMean > 0;
+}
+
+// Applies one input event (keystroke, backspace or paste burst) to the
+// typed text. Errors are split evenly between substituted, skipped and
+// extra characters; substitutions and extras may be backspaced later.
+static void nextInput(SimulatedTypist& t, const LoadConfig& config, mt19937& gen) {
+    uniform_real_distribution<> chance(0.0, 1.0);
+
+    if (t.pendingError != NO_ERROR && chance(gen) < config.backspaceRate) {
+        t.typed.pop_back();
+        if (t.pendingError == SUBSTITUTED_CHAR) {
+            t.nextChar--;
+        }
+        t.pendingError = NO_ERROR;
+        return;
+    }
+    t.pendingError = NO_ERROR;
+
+    if (chance(gen) < config.burstRate) {
+        size_t n = min<size_t>(config.burstSize, t.target.length() - t.nextChar);
+        t.typed.append(t.target, t.nextChar, n);
+        t.nextChar += n;
+        return;
+    }
+
+    if (chance(gen) < config.errorRate) {
+        int kind = gen() % 3;
+        char wrong = 'a' + gen() % 26;
+        if (kind == 0) {
+            t.typed.push_back(wrong);
+            t.nextChar++;
+            t.pendingError = SUBSTITUTED_CHAR;
+        } else if (kind == 1) {
+            // Skipped character: the next one is typed in its place.
+            t.nextChar++;
+            if (t.nextChar < t.target.length()) {
+                t.typed.push_back(t.target[t.nextChar]);
+                t.nextChar++;
+            }
+        } else {
+            t.typed.push_back(wrong);
+            t.pendingError = EXTRA_CHAR;
+        }
+        return;
+    }
+
+    t.typed.push_back(t.target[t.nextChar]);
+    t.nextChar++;
+}
+
+static void runThread(vector<SimulatedTypist>* typists, size_t begin, size_t end, const LoadConfig* config,
+                      unsigned int seed, ThreadStats* stats) {
+    mt19937 gen(seed);
+    uniform_real_distribution<> jitter(0.5, 1.5);
+
+    // Interleave sessions by simulated time so faster typists send more
+    // events, as they would against a shared engine.
+    typedef pair<double, size_t> Pending;
+    priority_queue<Pending, vector<Pending>, greater<Pending>> queue;
+    for (size_t i = begin; i < end; i++) {
+        SimulatedTypist& t = (*typists)[i];
+        t.session.setAccuracyMode(config->mode);
+        t.session.startSession(t.target);
+        queue.push(Pending(t.clock, i));
+    }
+
+    while (!queue.empty()) {
+        size_t i = queue.top().second;
+        queue.pop();
+        SimulatedTypist& t = (*typists)[i];
+
+        size_t before = t.typed.length();
+        nextInput(t, *config, gen);
+        // The front end never sends more than the target length.
+        if (t.typed.length() > t.target.length()) {
+            t.typed.resize(t.target.length());
+        }
+        if (t.typed.length() > before) {
+            stats->chars += t.typed.length() - before;
+        }
+
+        auto start = chrono::steady_clock::now();
+        t.session.updateInput(t.typed);
+        auto updated = chrono::steady_clock::now();
+        double accuracy = t.session.accuracy();
+        auto end = chrono::steady_clock::now();
+        stats->updateLatencies.push_back(chrono::duration_cast<chrono::nanoseconds>(updated - start).count());
+        stats->accuracyLatencies.push_back(chrono::duration_cast<chrono::nanoseconds>(end - updated).count());
+        stats->events++;
+
+        t.clock += 60.0 / (t.wpm * 5.0) * jitter(gen);
+        if (t.finished()) {
+            stats->accuracySum += accuracy;
+            stats->wpmSum += t.session.wpm(t.clock - t.startClock);
+            stats->finished++;
+            continue;
+        }
+        queue.push(Pending(t.clock, i));
+    }
+}
+
+// Bytes held by one session after typing its whole passage.
+static double measureSessionBytes(const vector<string>& passages, int mode) {
+    size_t n = min<size_t>(passages.size(), 1000);
+    countAllocations = true;
+    long long before = liveBytes;
+    vector<TypingSession>* sessions = new vector<TypingSession>(n);
+    for (size_t i = 0; i < n; i++) {
+        (*sessions)[i].setAccuracyMode(mode);
+        (*sessions)[i].startSession(passages[i]);
+        (*sessions)[i].updateInput(passages[i]);
+    }
+    long long after = liveBytes;
+    delete sessions;
+    countAllocations = false;
+    return static_cast<double>(after - before) / n;
+}
+
+// Joins `words` dictionary words drawn with gen, so a given --seed always
+// produces the same passages.
+static string makePassage(const CompressedDictionary& dictionary, int words, mt19937& gen) {
+    uniform_int_distribution<> wordDis(0, dictionary.size() - 1);
+    string passage;
+    for (int i = 0; i < words; i++) {
+        if (i > 0) {
+            passage += ' ';
+        }
+        dictionary.appendWordAt(wordDis(gen), passage);
+    }
+    return passage;
+}
+
+static uint32_t percentile(vector<uint32_t>& values, double p) {
+    if (values.empty()) {
+        return 0;
+    }
+    size_t k = min(values.size() - 1, static_cast<size_t>(p * values.size()));
+    nth_element(values.begin(), values.begin() + k, values.end());
+    return values[k];
+}
+
+static void printLatencies(const char* call, vector<uint32_t>& values) {
+    printf("%-12s latency ns: p50 %u  p90 %u  p99 %u  p99.9 %u  max %u\n", call, percentile(values, 0.50),
+           percentile(values, 0.90), percentile(values, 0.99), percentile(values, 0.999), percentile(values, 1.0));
+}
+
+int main(int argc, char** argv) {
+    LoadConfig config;
+    if (!parseArgs(argc, argv, config)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    config.threads = min(config.threads, config.sessions);
+
+    const CompressedDictionary& dictionary = DICTIONARIES[0];
+    mt19937 gen(config.seed);
+    normal_distribution<> wpmDis(config.wpmMean, config.wpmStddev);
+    uniform_real_distribution<> startDis(0.0, 1.0);
+
+    vector<string> passages;
+    vector<SimulatedTypist> typists(config.sessions);
+    for (SimulatedTypist& t : typists) {
+        t.target = makePassage(dictionary, config.words, gen);
+        t.wpm = max(10.0, wpmDis(gen));
+        t.startClock = startDis(gen);
+        t.clock = t.startClock;
+        t.nextChar = 0;
+        t.pendingError = NO_ERROR;
+        passages.push_back(t.target);
+    }
+
+    vector<ThreadStats> stats(config.threads);
+    vector<thread> workers;
+    size_t perThread = (typists.size() + config.threads - 1) / config.threads;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < config.threads; i++) {
+        stats[i] = ThreadStats();
+        size_t begin = min(typists.size(), i * perThread);
+        size_t end = min(typists.size(), begin + perThread);
+        workers.push_back(thread(runThread, &typists, begin, end, &config, config.seed + i + 1, &stats[i]));
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    double wallSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    ThreadStats total = ThreadStats();
+    for (ThreadStats& s : stats) {
+        total.events += s.events;
+        total.chars += s.chars;
+        total.accuracySum += s.accuracySum;
+        total.wpmSum += s.wpmSum;
+        total.finished += s.finished;
+        total.updateLatencies.insert(total.updateLatencies.end(), s.updateLatencies.begin(),
+                                     s.updateLatencies.end());
+        total.accuracyLatencies.insert(total.accuracyLatencies.end(), s.accuracyLatencies.begin(),
+                                       s.accuracyLatencies.end());
+        vector<uint32_t>().swap(s.updateLatencies);
+        vector<uint32_t>().swap(s.accuracyLatencies);
+    }
+
+    printf("sessions: %d on %d threads, %d words each, %s accuracy\n", config.sessions, config.threads,
+           config.words, config.mode == ALIGNED_ACCURACY ? "aligned" : "positional");
+    printf("events: %lld (%lld chars) in %.2f s\n", total.events, total.chars, wallSeconds);
+    printf("throughput: %.0f keystrokes/s\n", total.events / wallSeconds);
+    printLatencies("updateInput", total.updateLatencies);
+    printLatencies("accuracy", total.accuracyLatencies);
+    printf("memory per session: %.0f bytes\n", measureSessionBytes(passages, config.mode));
+    if (total.finished > 0) {
+        printf("simulated typists: mean accuracy %.1f%%, mean wpm %.1f\n", total.accuracySum / total.finished,
+               total.wpmSum / total.finished);
+    }
+    return 0;
+}